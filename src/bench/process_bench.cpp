@@ -0,0 +1,211 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "customer.hpp"
+#include "fifo_queue/fifo_queue.hpp"
+#include "process/event_heap.hpp"
+#include "process/process.hpp"
+
+// Benchmark: coroutine process model vs hand-written arrival/departure event handlers
+// Customers arrive in a burst much faster than the servers can clear them, so almost every customer is in
+// the store at the same time (millions of suspended coroutine frames vs millions of queued Customer nodes)
+//
+// Usage: ./process_bench [customers] [servers]
+
+// Both models draw interarrival and service times from identical streams
+struct BenchRandom
+{
+    std::mt19937_64 engine;
+    std::exponential_distribution<double> arrivals;
+    std::exponential_distribution<double> services;
+
+    BenchRandom(double lambda, double mu) : engine(12345), arrivals(lambda), services(mu) {}
+};
+
+// Totals reported by each model, used to check both ran a statistically equivalent scenario
+struct BenchResult
+{
+    double seconds;
+    double end_time;
+    double total_wait_time;
+    long events;
+    long peak_in_system;
+};
+
+// ---------------- Hand-written event handlers ----------------
+
+// Event node for the handler baseline: arrivals and departures in one heap, waiting customers in FifoQueue
+struct HandlerEvent
+{
+    double time;
+    unsigned long long seq;
+    EventType type;
+};
+
+BenchResult runHandlers(long customers, int servers, double lambda, double mu)
+{
+    BenchRandom rng(lambda, mu);
+    EventHeap<HandlerEvent> events;
+    FifoQueue fifo;
+    unsigned long long seq = 0;
+
+    int server_available_cnt = servers;
+    long arrivals_scheduled = 0;
+    long in_system = 0;
+    BenchResult result = {0.0, 0.0, 0.0, 0, 0};
+
+    auto start = std::chrono::steady_clock::now();
+
+    // First arrival, every arrival schedules the next one
+    events.insert(HandlerEvent{rng.arrivals(rng.engine), seq++, ARRIVAL});
+    arrivals_scheduled++;
+
+    double current_time = 0.0;
+    while (!events.isEmpty())
+    {
+        HandlerEvent event = events.removeMin();
+        current_time = event.time;
+        result.events++;
+
+        if (event.type == ARRIVAL)
+        {
+            if (arrivals_scheduled < customers)
+            {
+                events.insert(HandlerEvent{current_time + rng.arrivals(rng.engine), seq++, ARRIVAL});
+                arrivals_scheduled++;
+            }
+
+            in_system++;
+            if (in_system > result.peak_in_system)
+            {
+                result.peak_in_system = in_system;
+            }
+
+            if (server_available_cnt > 0)
+            {
+                server_available_cnt--;
+                events.insert(HandlerEvent{current_time + rng.services(rng.engine), seq++, DEPARTURE});
+            }
+            else
+            {
+                fifo.enqueue(Customer(static_cast<float>(current_time), ARRIVAL));
+            }
+        }
+        else
+        {
+            in_system--;
+
+            if (!fifo.isEmpty())
+            {
+                Customer next_cust = fifo.dequeue();
+                result.total_wait_time += current_time - next_cust.arrivalTime;
+                events.insert(HandlerEvent{current_time + rng.services(rng.engine), seq++, DEPARTURE});
+            }
+            else
+            {
+                server_available_cnt++;
+            }
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.end_time = current_time;
+    return result;
+}
+
+// ---------------- Coroutine processes ----------------
+
+struct ProcessBench
+{
+    Scheduler scheduler;
+    Server server;
+    BenchRandom rng;
+    long customers;
+    long in_system;
+    BenchResult result;
+
+    ProcessBench(long n, int servers, double lambda, double mu)
+        : server(scheduler, servers), rng(lambda, mu), customers(n), in_system(0), result{0.0, 0.0, 0.0, 0, 0} {}
+
+    Process customer()
+    {
+        double arrival_time = scheduler.now();
+        result.events++;
+        in_system++;
+        if (in_system > result.peak_in_system)
+        {
+            result.peak_in_system = in_system;
+        }
+
+        co_await server.acquire();
+        result.total_wait_time += scheduler.now() - arrival_time;
+
+        co_await scheduler.delay(rng.services(rng.engine));
+        server.release();
+
+        result.events++;
+        in_system--;
+    }
+
+    Process arrivalSource()
+    {
+        for (long i = 0; i < customers; ++i)
+        {
+            co_await scheduler.delay(rng.arrivals(rng.engine));
+            scheduler.spawn(customer());
+        }
+    }
+};
+
+BenchResult runProcesses(long customers, int servers, double lambda, double mu)
+{
+    ProcessBench bench(customers, servers, lambda, mu);
+
+    auto start = std::chrono::steady_clock::now();
+
+    bench.scheduler.spawn(bench.arrivalSource());
+    bench.scheduler.run();
+
+    auto end = std::chrono::steady_clock::now();
+    bench.result.seconds = std::chrono::duration<double>(end - start).count();
+    bench.result.end_time = bench.scheduler.now();
+    return bench.result;
+}
+
+void printResult(const std::string &name, const BenchResult &result, long customers)
+{
+    std::cout << name << std::endl;
+    std::cout << "  time = " << result.seconds << " s (" << (result.seconds * 1e9 / customers) << " ns/customer)" << std::endl;
+    std::cout << "  events = " << result.events << ", peak customers in store = " << result.peak_in_system << std::endl;
+    std::cout << "  end time = " << result.end_time << ", total wait = " << result.total_wait_time << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    long customers = (argc > 1) ? std::atol(argv[1]) : 2000000;
+    int servers = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+    // Everyone arrives within about one time unit, service capacity is far lower
+    double lambda = static_cast<double>(customers);
+    double mu = 1.0;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "  PROCESS BENCH: " << customers << " customers, " << servers << " servers" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+
+    BenchResult handlers = runHandlers(customers, servers, lambda, mu);
+    printResult("--- Hand-written event handlers ---", handlers, customers);
+
+    BenchResult processes = runProcesses(customers, servers, lambda, mu);
+    printResult("--- Coroutine processes ---", processes, customers);
+
+    std::cout << "--------------------------------" << std::endl;
+    std::cout << " peak coroutine frames = " << FramePool::instance().getPeakFramesInUse() << std::endl;
+    std::cout << " slowdown (processes / handlers) = " << (processes.seconds / handlers.seconds) << "x" << std::endl;
+
+    return 0;
+}
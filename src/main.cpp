@@ -1,6 +1,12 @@
 #include <iostream>
 #include <string>
 #include "simulation/simulation.hpp"
+#include "process/process_simulation.hpp"
+
+// Transient comparison: hours the store is open, grid points, and simulated openings to average
+const float TRANSIENT_HOURS = 4.0f;
+const int TRANSIENT_STEPS = 8;
+const int TRANSIENT_REPLICATIONS = 2000;
 
 void runTest(const std::string &filename)
 {
@@ -21,6 +27,17 @@ void runTest(const std::string &filename)
 
         // Display simulation measures for comparison
         sim.printResults();
+
+        // Run the same scenario with customers written as coroutine processes and display for comparison
+        ProcessSimulation process_sim;
+        if (process_sim.loadParameters(filename))
+        {
+            process_sim.runSimulation();
+            process_sim.printResults();
+        }
+
+        // Store opens empty, compare the time-dependent solution against many simulated openings
+        sim.runTransientModel(TRANSIENT_HOURS, TRANSIENT_STEPS, TRANSIENT_REPLICATIONS);
     }
     else
     {
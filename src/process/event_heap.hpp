@@ -0,0 +1,109 @@
+#ifndef EVENT_HEAP_HPP
+#define EVENT_HEAP_HPP
+
+#include <stdexcept>
+#include <vector>
+
+// Min-Heap of scheduled events for the process-interaction layer
+// Same bubble up / bubble down scheme as PriorityQueue, but backed by a growable vector since a
+// process model can have millions of customers pending at once (PriorityQueue is capped at 200)
+// Event must provide a "time" key and a "seq" tie breaker so events at the same time keep FIFO order
+template <typename Event>
+class EventHeap
+{
+private:
+    std::vector<Event> heapArray;
+
+    // Calculate array index for parents and children within the heap
+    static int parent(int index) { return (index - 1) / 2; }
+    static int left_child(int index) { return (2 * index) + 1; }
+    static int right_child(int index) { return (2 * index) + 2; }
+
+    // True if a should leave the heap before b
+    static bool earlier(const Event &a, const Event &b)
+    {
+        return a.time < b.time || (a.time == b.time && a.seq < b.seq);
+    }
+
+    void bubble_up(int index)
+    {
+        // Hold the new element aside and shift parents down instead of swapping at every level
+        Event moving = heapArray[index];
+        while (index > 0 && earlier(moving, heapArray[parent(index)]))
+        {
+            heapArray[index] = heapArray[parent(index)];
+            index = parent(index);
+        }
+        heapArray[index] = moving;
+    }
+
+    void bubble_down(int index)
+    {
+        int size = getSize();
+        Event moving = heapArray[index];
+        while (true)
+        {
+            int left = left_child(index);
+            int right = right_child(index);
+            int smallest = left;
+
+            // No children left, heap property satisfied
+            if (left >= size)
+            {
+                break;
+            }
+            if (right < size && earlier(heapArray[right], heapArray[left]))
+            {
+                smallest = right;
+            }
+            if (!earlier(heapArray[smallest], moving))
+            {
+                break;
+            }
+
+            heapArray[index] = heapArray[smallest];
+            index = smallest;
+        }
+        heapArray[index] = moving;
+    }
+
+public:
+    // Queue Operations
+    void insert(const Event &new_event)
+    {
+        heapArray.push_back(new_event);
+        bubble_up(getSize() - 1);
+    }
+
+    Event removeMin()
+    {
+        if (isEmpty())
+        {
+            throw std::underflow_error("Event Heap is empty!");
+        }
+
+        // Save root, move last element to the root and bubble down
+        Event root = heapArray[0];
+        heapArray[0] = heapArray.back();
+        heapArray.pop_back();
+        if (!isEmpty())
+        {
+            bubble_down(0);
+        }
+        return root;
+    }
+
+    // Utility Declarations
+    const Event &peekMin() const
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Event Heap is empty!");
+        }
+        return heapArray[0];
+    }
+    bool isEmpty() const { return heapArray.empty(); }
+    int getSize() const { return static_cast<int>(heapArray.size()); }
+};
+
+#endif
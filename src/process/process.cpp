@@ -0,0 +1,257 @@
+#include "process.hpp"
+#include <new>
+#include <stdexcept>
+
+// ---------------- FramePool ----------------
+
+// Constructor and Destructor Definitions
+FramePool::FramePool()
+{
+    for (std::size_t i = 0; i < NUM_CLASSES; ++i)
+    {
+        free_lists[i] = nullptr;
+    }
+    frames_in_use = 0;
+    peak_frames_in_use = 0;
+}
+
+FramePool::~FramePool()
+{
+    for (char *chunk : chunks)
+    {
+        ::operator delete(chunk);
+    }
+}
+
+FramePool &FramePool::instance()
+{
+    static FramePool pool;
+    return pool;
+}
+
+void FramePool::refill(std::size_t class_index)
+{
+    std::size_t block_size = (class_index + 1) * CLASS_SIZE;
+    char *chunk = static_cast<char *>(::operator new(block_size * BLOCKS_PER_CHUNK));
+    chunks.push_back(chunk);
+
+    // Thread every block of the new chunk onto the free list for this size class
+    for (std::size_t i = 0; i < BLOCKS_PER_CHUNK; ++i)
+    {
+        FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + i * block_size);
+        block->next = free_lists[class_index];
+        free_lists[class_index] = block;
+    }
+}
+
+void *FramePool::allocate(std::size_t size)
+{
+    frames_in_use++;
+    if (frames_in_use > peak_frames_in_use)
+    {
+        peak_frames_in_use = frames_in_use;
+    }
+
+    // Oversized frames aren't worth pooling
+    if (size > MAX_POOLED_SIZE)
+    {
+        return ::operator new(size);
+    }
+
+    std::size_t class_index = (size + CLASS_SIZE - 1) / CLASS_SIZE - 1;
+    if (free_lists[class_index] == nullptr)
+    {
+        refill(class_index);
+    }
+
+    // Pop the head of the free list
+    FreeBlock *block = free_lists[class_index];
+    free_lists[class_index] = block->next;
+    return block;
+}
+
+void FramePool::deallocate(void *ptr, std::size_t size)
+{
+    frames_in_use--;
+
+    if (size > MAX_POOLED_SIZE)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    // Push the block back on the free list of its size class for the next frame to reuse
+    std::size_t class_index = (size + CLASS_SIZE - 1) / CLASS_SIZE - 1;
+    FreeBlock *block = static_cast<FreeBlock *>(ptr);
+    block->next = free_lists[class_index];
+    free_lists[class_index] = block;
+}
+
+// Utility Definitions
+long FramePool::getFramesInUse() const { return frames_in_use; }
+long FramePool::getPeakFramesInUse() const { return peak_frames_in_use; }
+
+// ---------------- Process ----------------
+
+Process::Process(std::coroutine_handle<promise_type> h)
+{
+    handle = h;
+}
+
+Process::Process(Process &&other) noexcept
+{
+    handle = other.handle;
+    other.handle = nullptr;
+}
+
+Process::~Process()
+{
+    // Only reached with a live handle if the process was created but never spawned
+    if (handle)
+    {
+        handle.destroy();
+    }
+}
+
+std::coroutine_handle<> Process::release()
+{
+    std::coroutine_handle<> h = handle;
+    handle = nullptr;
+    return h;
+}
+
+// ---------------- Scheduler ----------------
+
+// Constructor and Destructor Definitions
+Scheduler::Scheduler()
+{
+    current_time = 0.0;
+    next_seq = 0;
+    events_processed = 0;
+    stop_requested = false;
+}
+
+Scheduler::~Scheduler()
+{
+    // Processes left in the timeline after stop() are suspended mid-journey, free their frames
+    while (!events.isEmpty())
+    {
+        events.removeMin().handle.destroy();
+    }
+}
+
+void Scheduler::spawn(Process process)
+{
+    schedule(process.release(), current_time);
+}
+
+void Scheduler::schedule(std::coroutine_handle<> handle, double time)
+{
+    if (time < current_time)
+    {
+        throw std::invalid_argument("Cannot schedule a process in the past.");
+    }
+
+    ScheduledEvent event;
+    event.time = time;
+    event.seq = next_seq++;
+    event.handle = handle;
+    events.insert(event);
+}
+
+void Scheduler::run()
+{
+    stop_requested = false;
+
+    while (!events.isEmpty() && !stop_requested)
+    {
+        ScheduledEvent current_event = events.removeMin();
+        current_time = current_event.time;
+
+        // Continue the process from where it suspended, it runs until its next co_await or until it finishes
+        current_event.handle.resume();
+
+        events_processed++;
+    }
+}
+
+void Scheduler::stop() { stop_requested = true; }
+
+// Utility Definitions
+double Scheduler::now() const { return current_time; }
+long Scheduler::getEventsProcessed() const { return events_processed; }
+int Scheduler::getPendingEvents() const { return events.getSize(); }
+
+// ---------------- Server ----------------
+
+// Constructor and Destructor Definitions
+Server::Server(Scheduler &sched, int capacity) : scheduler(sched)
+{
+    server_available_cnt = capacity;
+    head = nullptr;
+    tail = nullptr;
+    queue_length = 0;
+}
+
+Server::~Server()
+{
+    // Customers still in line when the run was stopped never get served, free their frames
+    // Save the handle first since destroying the frame also destroys the awaiter it lives in
+    while (head != nullptr)
+    {
+        std::coroutine_handle<> h = head->handle;
+        head = head->next;
+        h.destroy();
+    }
+}
+
+bool Server::enqueue(AcquireAwaiter *waiter, std::coroutine_handle<> h)
+{
+    // Free server, keep running without suspending
+    if (server_available_cnt > 0)
+    {
+        server_available_cnt--;
+        return false;
+    }
+
+    // All servers busy, add the customer to the back of the line
+    waiter->handle = h;
+    waiter->next = nullptr;
+    if (head == nullptr)
+    {
+        head = waiter;
+        tail = waiter;
+    }
+    else
+    {
+        tail->next = waiter;
+        tail = waiter;
+    }
+    queue_length++;
+    return true;
+}
+
+void Server::release()
+{
+    if (head == nullptr)
+    {
+        server_available_cnt++;
+        return;
+    }
+
+    // Hand the server directly to the front of the line; the count of available servers doesn't change
+    // Resume through the scheduler at the current time rather than inline so the releasing process finishes first
+    AcquireAwaiter *next_waiter = head;
+    head = head->next;
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
+    queue_length--;
+
+    scheduler.schedule(next_waiter->handle, scheduler.now());
+}
+
+// Utility Definitions
+int Server::getAvailable() const { return server_available_cnt; }
+int Server::getQueueLength() const { return queue_length; }
@@ -0,0 +1,200 @@
+#ifndef PROCESS_HPP
+#define PROCESS_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <vector>
+#include "event_heap.hpp"
+
+// Process-interaction layer built on C++20 coroutines
+// Instead of splitting a customer into processArrival / processDeparture callbacks, a customer is written
+// as one sequential function that suspends while it waits:
+//
+//     Process customer(Scheduler &sched, Server &server)
+//     {
+//         co_await server.acquire();      // wait in line for a free server
+//         co_await sched.delay(service);  // being served
+//         server.release();               // hand the server to the next customer in line
+//     }
+//
+// Every suspended customer is resumed from Scheduler::run(), which is the same remove-min / dispatch
+// event loop as Simulation::runSimulation()
+
+// Pooled allocator for coroutine frames
+// Frames are rounded up to a size class and recycled through a free list, so spawning millions of
+// customers does not hit the global heap once per customer
+class FramePool
+{
+private:
+    static const std::size_t CLASS_SIZE = 64;        // granularity of size classes in bytes
+    static const std::size_t MAX_POOLED_SIZE = 1024; // larger frames fall back to ::operator new
+    static const std::size_t NUM_CLASSES = MAX_POOLED_SIZE / CLASS_SIZE;
+    static const std::size_t BLOCKS_PER_CHUNK = 4096;
+
+    // Freed frames are threaded through their own first bytes
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    FreeBlock *free_lists[NUM_CLASSES];
+    std::vector<char *> chunks; // every chunk carved so far, released when the pool is destroyed
+
+    long frames_in_use;
+    long peak_frames_in_use;
+
+    FramePool();
+    ~FramePool();
+
+    void refill(std::size_t class_index); // carve a new chunk into free blocks of one size class
+
+public:
+    FramePool(const FramePool &) = delete;
+    FramePool &operator=(const FramePool &) = delete;
+
+    // Single pool shared by all coroutine frames (the simulation is single threaded)
+    static FramePool &instance();
+
+    void *allocate(std::size_t size);
+    void deallocate(void *ptr, std::size_t size);
+
+    // Utility Declarations
+    long getFramesInUse() const;
+    long getPeakFramesInUse() const;
+};
+
+// Coroutine return type for a simulated process (customer, arrival source, ...)
+// A new Process starts suspended and runs once it is handed to Scheduler::spawn()
+// The frame destroys itself when the process body finishes
+class Process
+{
+public:
+    struct promise_type
+    {
+        Process get_return_object() { return Process(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { throw; }
+
+        // Route frame allocation through the pool
+        static void *operator new(std::size_t size) { return FramePool::instance().allocate(size); }
+        static void operator delete(void *ptr, std::size_t size) { FramePool::instance().deallocate(ptr, size); }
+    };
+
+    Process(Process &&other) noexcept;
+    Process(const Process &) = delete;
+    Process &operator=(const Process &) = delete;
+    ~Process(); // destroy the frame if the process was never spawned
+
+    // Give up ownership of the frame, used by the scheduler once the process is started
+    std::coroutine_handle<> release();
+
+private:
+    explicit Process(std::coroutine_handle<promise_type> h);
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Event loop that resumes suspended processes in time order
+class Scheduler
+{
+private:
+    // A process waiting to be resumed at a given time
+    struct ScheduledEvent
+    {
+        double time;
+        unsigned long long seq; // insertion order, keeps same-time events FIFO
+        std::coroutine_handle<> handle;
+    };
+
+    EventHeap<ScheduledEvent> events;
+    double current_time;
+    unsigned long long next_seq;
+    long events_processed;
+    bool stop_requested;
+
+public:
+    // Awaitable returned by delay(): suspend and resume after dt time units
+    struct DelayAwaiter
+    {
+        Scheduler &scheduler;
+        double dt;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) { scheduler.schedule(h, scheduler.now() + dt); }
+        void await_resume() const noexcept {}
+    };
+
+    Scheduler();
+    ~Scheduler(); // destroy any processes still pending when the run was stopped early
+
+    Scheduler(const Scheduler &) = delete;
+    Scheduler &operator=(const Scheduler &) = delete;
+
+    // Start a process at the current time
+    void spawn(Process process);
+
+    // Resume a suspended process at an absolute time (never earlier than now)
+    void schedule(std::coroutine_handle<> handle, double time);
+
+    // co_await sched.delay(dt) inside a process to let dt time units pass
+    DelayAwaiter delay(double dt) { return DelayAwaiter{*this, dt}; }
+
+    // Process events until none are left or stop() is called
+    void run();
+    void stop();
+
+    // Utility Declarations
+    double now() const;
+    long getEventsProcessed() const;
+    int getPendingEvents() const;
+};
+
+// Pool of c identical servers with a single shared FIFO line
+// Waiting customers are kept in an intrusive linked list through their acquire awaiters (like nextCust
+// in Customer), so waiting in line costs no allocation beyond the coroutine frame itself
+class Server
+{
+public:
+    // Awaitable returned by acquire(): take a free server or wait in line for one
+    struct AcquireAwaiter
+    {
+        Server &server;
+        std::coroutine_handle<> handle;
+        AcquireAwaiter *next;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) { return server.enqueue(this, h); }
+        void await_resume() const noexcept {}
+    };
+
+    Server(Scheduler &sched, int capacity);
+    ~Server(); // destroy any processes still waiting in line
+
+    Server(const Server &) = delete;
+    Server &operator=(const Server &) = delete;
+
+    // co_await server.acquire() inside a process to get a server
+    AcquireAwaiter acquire() { return AcquireAwaiter{*this, nullptr, nullptr}; }
+
+    // Give the server back; if anyone is waiting it is handed straight to the head of the line
+    void release();
+
+    // Utility Declarations
+    int getAvailable() const;
+    int getQueueLength() const;
+
+private:
+    Scheduler &scheduler;
+    int server_available_cnt;
+
+    AcquireAwaiter *head; // next to be served
+    AcquireAwaiter *tail; // last in line
+    int queue_length;
+
+    // Returns false (don't suspend) if a server was free, otherwise joins the line
+    bool enqueue(AcquireAwaiter *waiter, std::coroutine_handle<> h);
+};
+
+#endif
@@ -0,0 +1,177 @@
+#include "process_simulation.hpp"
+#include <iostream>
+#include <fstream>
+#include <cmath>   // log
+#include <cstdlib> // rand, same generator and stream as Simulation
+#include <iomanip> // for formatting and setting precision
+#include <stdexcept>
+
+// Constructor and Destructor
+ProcessSimulation::ProcessSimulation()
+{
+    lambda = 0.0f;
+    mu = 0.0f;
+    M = 0;
+    total_events = 0;
+
+    servers = nullptr;
+    events_processed = 0;
+
+    total_wait_time = 0.0f;
+    total_service_time = 0.0f;
+    total_idle_time = 0.0f;
+    customer_waited_cnt = 0;
+    total_customers = 0;
+
+    customers_in_system = 0;
+    last_empty_time = 0.0f;
+
+    // No srand here: rand is seeded once by Simulation, reseeding would restart the stream it shares with Simulation
+}
+
+ProcessSimulation::~ProcessSimulation()
+{
+    // Servers go first so customers still waiting in line are freed before the scheduler frees the rest
+    delete servers;
+}
+
+// Load input params from file, return false if failed to load
+bool ProcessSimulation::loadParameters(const std::string &filename)
+{
+    std::ifstream input_file(filename);
+
+    if (!input_file.is_open())
+    {
+        std::cerr << "Error: Could not open file " << filename << std::endl;
+        return false;
+    }
+
+    // Read lambda, mu, M, total events and then end file stream
+    input_file >> lambda;
+    input_file >> mu;
+    input_file >> M;
+    input_file >> total_events;
+
+    input_file.close();
+
+    delete servers;
+    servers = new Server(scheduler, M);
+
+    return true;
+}
+
+// Utility Definitions
+
+// Exponential interval with the given average rate, same method as Simulation::getNextRandomInterval
+float ProcessSimulation::getNextRandomInterval(float avg)
+{
+    float f = (float)std::rand() / RAND_MAX;
+    while (f == 0.0f)
+    {
+        f = (float)std::rand() / RAND_MAX;
+    }
+
+    return -1.0f * (1.0f / avg) * std::log(f);
+}
+
+void ProcessSimulation::countEvent()
+{
+    events_processed++;
+    if (events_processed >= total_events)
+    {
+        scheduler.stop();
+    }
+}
+
+// Processes
+
+Process ProcessSimulation::arrivalSource()
+{
+    // Runs for as long as the scheduler does; its frame is freed when the run is stopped
+    while (true)
+    {
+        co_await scheduler.delay(getNextRandomInterval(lambda));
+        scheduler.spawn(customer());
+    }
+}
+
+Process ProcessSimulation::customer()
+{
+    // Arrive (kept at scheduler precision so a customer served immediately has exactly zero wait)
+    double arrival_time = scheduler.now();
+    total_customers++;
+    countEvent();
+
+    // Servers were fully idle until this customer walked into an empty store
+    if (customers_in_system == 0)
+    {
+        total_idle_time += (arrival_time - last_empty_time);
+    }
+    customers_in_system++;
+
+    // Wait in line until a server is free
+    co_await servers->acquire();
+
+    float wait_time = scheduler.now() - arrival_time;
+    if (wait_time > 0)
+    {
+        customer_waited_cnt++;
+        total_wait_time += wait_time;
+    }
+
+    // Get served
+    float interval = getNextRandomInterval(mu);
+    total_service_time += interval;
+    co_await scheduler.delay(interval);
+
+    // Depart
+    servers->release();
+    countEvent();
+
+    customers_in_system--;
+    if (customers_in_system == 0)
+    {
+        last_empty_time = scheduler.now();
+    }
+}
+
+void ProcessSimulation::runSimulation()
+{
+    if (servers == nullptr)
+    {
+        throw std::runtime_error("Parameters must be loaded before running the process model.");
+    }
+
+    events_processed = 0;
+
+    scheduler.spawn(arrivalSource());
+    scheduler.run();
+}
+
+void ProcessSimulation::printResults()
+{
+    float current_time = scheduler.now();
+
+    // Add idle time resulting from the simulation ending with servers idle to the total
+    if (customers_in_system == 0)
+    {
+        total_idle_time += (current_time - last_empty_time);
+    }
+
+    // Calculate and print the same measures as Simulation::printResults
+    float sim_Po = total_idle_time / current_time;
+    float sim_W = (total_wait_time + total_service_time) / total_customers;
+    float sim_Wq = total_wait_time / total_customers;
+    float sim_rho = total_service_time / (M * current_time);
+    float prob_wait = static_cast<float>(customer_waited_cnt) / total_customers;
+
+    std::cout << "--- Process Model Results ---" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << " Po = " << sim_Po << std::endl;
+    std::cout << " W = " << sim_W << std::endl;
+    std::cout << " Wq = " << sim_Wq << std::endl;
+    std::cout << " rho = " << sim_rho << std::endl;
+    std::cout << " Probability of waiting = " << prob_wait << std::endl;
+    std::cout << "--------------------------------\n"
+              << std::endl;
+}
@@ -0,0 +1,63 @@
+#ifndef PROCESS_SIMULATION_HPP
+#define PROCESS_SIMULATION_HPP
+
+#include <string>
+#include "process.hpp"
+
+// Same M/M/c model as Simulation, but each customer is written as one coroutine (see customer())
+// instead of the processArrival / processDeparture callbacks, so the two sets of results can be compared
+
+class ProcessSimulation
+{
+private:
+    // Input Parameters
+    float lambda;     // Arrival rate
+    float mu;         // Service rate
+    int M;            // # of servers
+    int total_events; // # of arrivals/departures to simulate
+
+    // Event loop and the shared servers
+    Scheduler scheduler;
+    Server *servers; // created once M is known
+
+    int events_processed;
+
+    // Variables for Holding Simulation Results
+    float total_wait_time;
+    float total_service_time;
+    float total_idle_time;
+    int customer_waited_cnt;
+    int total_customers;
+
+    // Track when the system last became empty to calculate idle time (P sub 0)
+    int customers_in_system;
+    float last_empty_time;
+
+    // Helper Declarations
+    float getNextRandomInterval(float avg);
+
+    // Count an arrival or departure and stop the event loop once total_events is reached
+    void countEvent();
+
+    // Processes
+    Process arrivalSource(); // spawns customers with exponential interarrival times
+    Process customer();      // one customer's journey through the store
+
+public:
+    ProcessSimulation();
+    ~ProcessSimulation();
+
+    ProcessSimulation(const ProcessSimulation &) = delete;
+    ProcessSimulation &operator=(const ProcessSimulation &) = delete;
+
+    // Load input parameters from file, return false if failed to load
+    bool loadParameters(const std::string &filename);
+
+    // Run the process model until total_events arrivals/departures have been processed
+    void runSimulation();
+
+    // Print the results of the process model to the console in the same format as Simulation
+    void printResults();
+};
+
+#endif
@@ -1,6 +1,8 @@
 #include "simulation.hpp"
+#include "../transient/transient_model.hpp"
 #include <iostream>
 #include <fstream>
+#include <climits> // INT_MAX
 #include <cmath>   // log, pow
 #include <cstdlib> // using this and ctime for randomness to comply with your instructions
 #include <ctime>   // otherwise would have used Mersenne Twister
@@ -27,7 +29,13 @@ Simulation::Simulation()
     last_departure_time = 0.0f;
 
     // Seed random generator for Poisson distribution
-    std::srand(std::time(nullptr));
+    // Only once, replications created in the same second would otherwise all replay the same sequence
+    static bool seeded = false;
+    if (!seeded)
+    {
+        std::srand(std::time(nullptr));
+        seeded = true;
+    }
 }
 
 // Load input params from file, return false if failed to load
@@ -140,6 +148,60 @@ void Simulation::runAnalyticalModel()
     std::cout << "--------------------------------" << std::endl;
 }
 
+void Simulation::runTransientModel(float end_time, int steps, int replications)
+{
+    std::cout << "--- Transient Model Results (store opens empty) ---" << std::endl;
+
+    // Evenly spaced time grid from opening to end_time
+    std::vector<double> times;
+    std::vector<float> grid;
+    for (int i = 0; i <= steps; ++i)
+    {
+        times.push_back(end_time * i / steps);
+        grid.push_back(end_time * i / steps);
+    }
+
+    // Numerical solution of the birth-death chain
+    TransientModel model(lambda, mu, M);
+    std::vector<TransientPoint> points = model.solve(times);
+
+    // Average of independent simulated openings, each sampled on the same grid
+    std::vector<double> sim_P0(grid.size(), 0.0);
+    std::vector<double> sim_L(grid.size(), 0.0);
+    std::vector<double> sim_Lq(grid.size(), 0.0);
+    for (int r = 0; r < replications; ++r)
+    {
+        Simulation replication;
+        replication.lambda = lambda;
+        replication.mu = mu;
+        replication.M = M;
+        // No event limit, the time grid ends each replication once end_time has been passed
+        replication.total_events = INT_MAX;
+        replication.sample_times = grid;
+        replication.runSimulation();
+
+        for (std::size_t i = 0; i < grid.size(); ++i)
+        {
+            int n = replication.sampled_in_system[i];
+            sim_P0[i] += (n == 0) ? 1.0 : 0.0;
+            sim_L[i] += n;
+            sim_Lq[i] += (n > M) ? (n - M) : 0;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "     t    Po(t)   sim Po      L(t)    sim L     Lq(t)   sim Lq" << std::endl;
+    for (std::size_t i = 0; i < grid.size(); ++i)
+    {
+        std::cout << std::setw(6) << points[i].time
+                  << std::setw(9) << points[i].probabilities[0] << std::setw(9) << sim_P0[i] / replications
+                  << std::setw(10) << points[i].L << std::setw(9) << sim_L[i] / replications
+                  << std::setw(10) << points[i].Lq << std::setw(9) << sim_Lq[i] / replications << std::endl;
+    }
+    std::cout << " (simulated columns averaged over " << replications << " replications)" << std::endl;
+    std::cout << "--------------------------------" << std::endl;
+}
+
 void Simulation::runSimulation()
 {
     // Place first arrival in queue
@@ -161,6 +223,13 @@ void Simulation::runSimulation()
     while (!pq.isEmpty() && events_processed < total_events)
     {
         Customer current_event = pq.removeMin();
+
+        // Stop once every requested sample time has been recorded
+        if (!recordSamples(current_event.pqTime))
+        {
+            break;
+        }
+
         current_time = current_event.pqTime;
 
         // Departure time == 0 means arrival event
@@ -192,6 +261,23 @@ void Simulation::runSimulation()
     }
 }
 
+bool Simulation::recordSamples(float event_time)
+{
+    if (sample_times.empty())
+    {
+        return true;
+    }
+
+    // The store doesn't change between events, so every grid time before this event sees the current state
+    int in_system = (M - server_available_cnt) + fifo.getSize();
+    while (sampled_in_system.size() < sample_times.size() && sample_times[sampled_in_system.size()] < event_time)
+    {
+        sampled_in_system.push_back(in_system);
+    }
+
+    return sampled_in_system.size() < sample_times.size();
+}
+
 void Simulation::processArrival(Customer &event)
 {
     total_customers++;
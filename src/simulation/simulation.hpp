@@ -2,6 +2,7 @@
 #define SIMULATION_HPP
 
 #include <string>
+#include <vector>
 #include "../customer.hpp"
 #include "../priority_queue/priority_queue.hpp"
 #include "../fifo_queue/fifo_queue.hpp"
@@ -37,6 +38,11 @@ private:
     // Track the time of last departure to calculate server idle time (P sub 0)
     float last_departure_time;
 
+    // Optional time grid (ascending) at which to record the number of customers in the store
+    // When set, runSimulation stops once the last grid time has been passed
+    std::vector<float> sample_times;
+    std::vector<int> sampled_in_system;
+
     // Helper Declarations
     float getNextRandomInterval(float avg);
     long double factorial(int n); // Needed for the analytical math formulas
@@ -45,6 +51,9 @@ private:
     void processArrival(Customer &event);
     void processDeparture(Customer &event);
 
+    // Record the current number of customers for every grid time before event_time, return false once the grid is done
+    bool recordSamples(float event_time);
+
 public:
     Simulation();
 
@@ -54,6 +63,10 @@ public:
     // Use provided forumulas to calculate analytical results that estimate the results of longer simulations
     void runAnalyticalModel();
 
+    // Solve P_n(t), L(t) and Lq(t) over [0, end_time] for a store that opens empty (uniformization) and print them
+    // next to the average of the given number of simulated replications over the same time grid
+    void runTransientModel(float end_time, int steps, int replications);
+
     // Run the sim of the application to process events until total_events have been processed
     void runSimulation();
 
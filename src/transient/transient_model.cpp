@@ -0,0 +1,182 @@
+#include "transient_model.hpp"
+#include <algorithm> // min, max
+#include <cmath>     // exp, ceil
+#include <stdexcept>
+
+// Largest Lambda * h handled in one uniformization step; longer intervals are split so e^(-Lambda h) can't underflow
+// and the number of Poisson terms per step stays small
+static const double MAX_STEP_RATE = 20.0;
+
+// Constructor
+TransientModel::TransientModel(double lambda, double mu, int M, double tolerance)
+{
+    if (lambda <= 0.0 || mu <= 0.0 || M <= 0)
+    {
+        throw std::invalid_argument("Transient model needs lambda > 0, mu > 0 and at least one server.");
+    }
+
+    this->lambda = lambda;
+    this->mu = mu;
+    this->M = M;
+    this->tolerance = tolerance;
+
+    uniform_rate = lambda + M * mu;
+}
+
+// Helper Definitions
+
+void TransientModel::buildDiagonals(int num_states)
+{
+    from_below.assign(num_states, 0.0);
+    stay.assign(num_states, 0.0);
+    from_above.assign(num_states, 0.0);
+
+    for (int n = 0; n < num_states; ++n)
+    {
+        // Last kept state doesn't accept arrivals so no probability leaks out of the truncated chain
+        double up = (n + 1 < num_states) ? lambda / uniform_rate : 0.0;
+        double down = std::min(n, M) * mu / uniform_rate;
+
+        stay[n] = 1.0 - up - down;
+        if (n + 1 < num_states)
+        {
+            from_below[n + 1] = up;
+        }
+        if (n > 0)
+        {
+            from_above[n - 1] = down;
+        }
+    }
+}
+
+void TransientModel::multiply(const std::vector<double> &in, std::vector<double> &out) const
+{
+    int num_states = static_cast<int>(in.size());
+    out.resize(num_states);
+
+    if (num_states == 1)
+    {
+        out[0] = stay[0] * in[0];
+        return;
+    }
+
+    // __restrict: in, out and the diagonals never overlap
+    const double *__restrict x = in.data();
+    const double *__restrict below = from_below.data();
+    const double *__restrict diag = stay.data();
+    const double *__restrict above = from_above.data();
+    double *__restrict y = out.data();
+
+    // Edges handled separately so the interior loop is branch free
+    // omp simd forces vectorization, gcc's -O2 cost model rejects this loop otherwise (Makefile builds with -O2 -fopenmp-simd)
+    y[0] = diag[0] * x[0] + above[0] * x[1];
+#pragma omp simd
+    for (int n = 1; n < num_states - 1; ++n)
+    {
+        y[n] = below[n] * x[n - 1] + diag[n] * x[n] + above[n] * x[n + 1];
+    }
+    y[num_states - 1] = below[num_states - 1] * x[num_states - 2] + diag[num_states - 1] * x[num_states - 1];
+}
+
+void TransientModel::fitStateSpace(std::vector<double> &p, int max_jumps)
+{
+    // Drop negligible states off the top, then leave room for max_jumps more arrivals plus the absorbing top state
+    // Each Poisson term moves probability at most one state, so nothing reaches the top state within this step
+    int top = static_cast<int>(p.size()) - 1;
+    while (top > 0 && p[top] < tolerance)
+    {
+        top--;
+    }
+
+    int num_states = top + max_jumps + 2;
+    p.resize(num_states, 0.0);
+
+    if (static_cast<int>(stay.size()) != num_states)
+    {
+        buildDiagonals(num_states);
+    }
+}
+
+void TransientModel::advance(std::vector<double> &p, double h)
+{
+    double a = uniform_rate * h;
+
+    // Poisson(a) weights, cut off once everything but tolerance is accounted for
+    std::vector<double> weights;
+    double weight = std::exp(-a);
+    double cumulative = weight;
+    weights.push_back(weight);
+    for (int k = 1; cumulative < 1.0 - tolerance && weight > 0.0; ++k)
+    {
+        weight *= a / k;
+        cumulative += weight;
+        weights.push_back(weight);
+    }
+    int max_jumps = static_cast<int>(weights.size()) - 1;
+
+    fitStateSpace(p, max_jumps);
+
+    // result = sum of weights[k] * p P^k
+    std::vector<double> term = p;
+    std::vector<double> next_term;
+    std::vector<double> result(p.size());
+    for (std::size_t n = 0; n < p.size(); ++n)
+    {
+        result[n] = weights[0] * term[n];
+    }
+    for (int k = 1; k <= max_jumps; ++k)
+    {
+        multiply(term, next_term);
+        term.swap(next_term);
+        for (std::size_t n = 0; n < p.size(); ++n)
+        {
+            result[n] += weights[k] * term[n];
+        }
+    }
+
+    p.swap(result);
+}
+
+std::vector<TransientPoint> TransientModel::solve(const std::vector<double> &times)
+{
+    std::vector<TransientPoint> points;
+
+    // Store opens empty
+    std::vector<double> p(1, 1.0);
+    double t = 0.0;
+
+    for (double target : times)
+    {
+        if (target < t)
+        {
+            throw std::invalid_argument("Transient time grid must be ascending and start at or after 0.");
+        }
+
+        // Split the interval into steps short enough for a well-conditioned Poisson sum
+        double interval = target - t;
+        int steps = std::max(1, static_cast<int>(std::ceil(uniform_rate * interval / MAX_STEP_RATE)));
+        for (int i = 0; i < steps && interval > 0.0; ++i)
+        {
+            advance(p, interval / steps);
+        }
+        t = target;
+
+        // Summary measures at this time
+        TransientPoint point;
+        point.time = t;
+        point.probabilities = p;
+        point.L = 0.0;
+        point.Lq = 0.0;
+        for (std::size_t n = 0; n < p.size(); ++n)
+        {
+            point.L += n * p[n];
+            if (static_cast<int>(n) > M)
+            {
+                point.Lq += (n - M) * p[n];
+            }
+        }
+        points.push_back(point);
+    }
+
+    return points;
+}
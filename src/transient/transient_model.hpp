@@ -0,0 +1,52 @@
+#ifndef TRANSIENT_MODEL_HPP
+#define TRANSIENT_MODEL_HPP
+
+#include <vector>
+
+// Time-dependent solution of the M/M/c birth-death chain for a store that opens empty at t = 0
+// Steady-state formulas (Simulation::runAnalyticalModel) only hold once the store has been open for a while,
+// this computes P_n(t), L(t) and Lq(t) at any time instead, and also works when lambda >= c * mu
+//
+// Method is uniformization: with Lambda = lambda + c * mu (fastest possible exit rate of any state),
+//     p(t + h) = sum over k of  e^(-Lambda h) (Lambda h)^k / k!  *  p(t) P^k,    P = I + Q / Lambda
+// where P is tridiagonal, so each term is one sparse tridiagonal matrix-vector product
+
+// Solution at one point of the time grid
+struct TransientPoint
+{
+    double time;
+    std::vector<double> probabilities; // P_n(t) for n = 0 .. number of states kept at time t
+    double L;                          // expected number of customers in the store
+    double Lq;                         // expected number of customers waiting in line
+};
+
+class TransientModel
+{
+private:
+    // Input Parameters
+    double lambda;    // Arrival rate
+    double mu;        // Service rate
+    int M;            // # of servers
+    double tolerance; // probability mass allowed to be dropped per step (Poisson tail and state space tail)
+
+    double uniform_rate; // Lambda
+
+    // Tridiagonal transition matrix P stored by diagonal so (p P)[n] = from_below[n] p[n-1] + stay[n] p[n] + from_above[n] p[n+1]
+    std::vector<double> from_below;
+    std::vector<double> stay;
+    std::vector<double> from_above;
+
+    // Helper Declarations
+    void buildDiagonals(int num_states);                                          // rebuild P for states 0 .. num_states - 1
+    void multiply(const std::vector<double> &in, std::vector<double> &out) const; // out = in P
+    void fitStateSpace(std::vector<double> &p, int max_jumps);                    // automatic truncation before a step
+    void advance(std::vector<double> &p, double h);                               // p(t) -> p(t + h)
+
+public:
+    TransientModel(double lambda, double mu, int M, double tolerance = 1e-12);
+
+    // Solve at every time in the grid (ascending, >= 0) starting from an empty store at t = 0
+    std::vector<TransientPoint> solve(const std::vector<double> &times);
+};
+
+#endif